@@ -0,0 +1,91 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <random>
+
+#include "types.hh"
+
+// Stack of directions, four entries per byte. Each entry is the step taken
+// from the previous cell, so popping it and moving the opposite way goes back.
+class DirStack {
+public:
+    bool empty() const { return size_ == 0; }
+
+    void push(Dir d) {
+        if (size_ % 4 == 0) bits_.push_back(0);
+        bits_[size_ / 4] |= static_cast<uint8_t>((static_cast<int>(d) - 1) << (size_ % 4 * 2));
+        ++size_;
+    }
+
+    Dir pop() {
+        --size_;
+        const int shift = size_ % 4 * 2;
+        uint8_t& byte = bits_[size_ / 4];
+        Dir d = static_cast<Dir>(((byte >> shift) & 3) + 1);
+        byte &= static_cast<uint8_t>(~(3 << shift));
+        if (size_ % 4 == 0) bits_.pop_back();
+        return d;
+    }
+
+private:
+    std::vector<uint8_t> bits_;
+    std::size_t size_ = 0;
+};
+
+// Depth first (recursive backtracker) generator. Produces long corridors
+// instead of the uniform spanning tree of Maze. Iterative, so it does not
+// overflow the call stack on large grids; visited state is kept in the cells
+// and the backtrack stack costs 2 bits per cell on the current path.
+class Backtracker {
+public:
+    Backtracker(int64_t w, int64_t h)
+        : w_{w}
+        , h_{h}
+        , a(w, std::vector<Cell>(h))
+        , gen_{std::random_device{}()}
+    {
+    }
+
+    Backtracker(int64_t w, int64_t h, uint32_t seed)
+        : w_{w}
+        , h_{h}
+        , a(w, std::vector<Cell>(h))
+        , gen_{seed}
+    {
+    }
+
+    void generate() {
+        DirStack stack;
+        Point cur{0, 0};
+        a[0][0].state = CellState::TREE;
+        while (true) {
+            Dir next[4];
+            int n = 0;
+            if (cur.x > 0      && a[cur.x - 1][cur.y].state == CellState::NONE) next[n++] = Dir::LEFT;
+            if (cur.y > 0      && a[cur.x][cur.y - 1].state == CellState::NONE) next[n++] = Dir::UP;
+            if (cur.x < w_ - 1 && a[cur.x + 1][cur.y].state == CellState::NONE) next[n++] = Dir::RIGHT;
+            if (cur.y < h_ - 1 && a[cur.x][cur.y + 1].state == CellState::NONE) next[n++] = Dir::DOWN;
+
+            // Dead end, step back along the path
+            if (n == 0) {
+                if (stack.empty()) return;
+                cur.moveto(opposite(stack.pop()));
+                continue;
+            }
+
+            Dir d = next[std::uniform_int_distribution<>{0, n - 1}(gen_)];
+            cur.moveto(d);
+            a[cur.x][cur.y].state = CellState::TREE;
+            a[cur.x][cur.y].parent = opposite(d);
+            stack.push(d);
+        }
+    }
+
+    const Cells& cells() const { return a; }
+
+private:
+    int64_t w_;
+    int64_t h_;
+    std::vector<std::vector<Cell>> a;
+    std::mt19937 gen_; //Standard mersenne_twister_engine seeded with random_device or the given seed
+};
@@ -0,0 +1,58 @@
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include "libmaze.h"
+#include "maze.hh"
+
+// Per call cost of the C API on small mazes, against a Maze whose nested
+// vectors are copied out cell by cell as the bindings used to do
+int main(int argc, char* argv[]) {
+    const int iterations = argc > 1 ? std::stoi(argv[1]) : 20000;
+    const int CELL_SIZE = 4;
+    using clock = std::chrono::steady_clock;
+    auto nsPerCall = [&](clock::time_point start) {
+        return std::chrono::duration<double, std::nano>(clock::now() - start).count() / iterations;
+    };
+
+    for (int n : {4, 8, 16, 32}) {
+        std::vector<maze_cell> cells(n * n);
+        std::vector<uint8_t> rgb(maze_image_size(n, n, CELL_SIZE));
+
+        auto start = clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            maze_generate(cells.data(), n, n, i);
+        }
+        const double generate = nsPerCall(start);
+
+        start = clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            maze_render(cells.data(), n, n, CELL_SIZE, 1, rgb.data());
+        }
+        const double render = nsPerCall(start);
+
+        // Includes starting threads - 1 threads on every call
+        start = clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            maze_render(cells.data(), n, n, CELL_SIZE, 4, rgb.data());
+        }
+        const double render4 = nsPerCall(start);
+
+        start = clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            Maze m(n, n);
+            m.generate();
+            for (int x = 0; x < n; ++x) {
+                for (int y = 0; y < n; ++y) {
+                    cells[y * n + x].parent = static_cast<uint8_t>(m.cells()[x][y].parent);
+                }
+            }
+        }
+        const double copied = nsPerCall(start);
+
+        std::cout << n << "x" << n
+                  << "  maze_generate " << generate << " ns"
+                  << "  maze_render " << render << " ns"
+                  << "  maze_render 4 threads " << render4 << " ns"
+                  << "  Maze + copy " << copied << " ns" << std::endl;
+    }
+}
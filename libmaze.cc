@@ -0,0 +1,112 @@
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "libmaze.h"
+#include "maze.hh"
+#include "render.hh"
+
+static_assert(sizeof(maze_cell) == sizeof(Cell), "maze_cell must match Cell");
+static_assert(offsetof(maze_cell, state) == offsetof(Cell, state), "maze_cell must match Cell");
+static_assert(offsetof(maze_cell, parent) == offsetof(Cell, parent), "maze_cell must match Cell");
+static_assert(MAZE_LEFT == static_cast<int>(Dir::LEFT) && MAZE_UP == static_cast<int>(Dir::UP) &&
+              MAZE_RIGHT == static_cast<int>(Dir::RIGHT) && MAZE_DOWN == static_cast<int>(Dir::DOWN),
+              "MAZE_* must match Dir");
+
+namespace {
+
+// Read only users never write through it, the const_cast only saves a
+// second span type
+CellSpan span(const maze_cell* cells, int64_t w, int64_t h) {
+    return {reinterpret_cast<Cell*>(const_cast<maze_cell*>(cells)), w, h};
+}
+
+bool validSize(int64_t w, int64_t h) {
+    return w > 0 && h > 0 && static_cast<uint64_t>(w) <= SIZE_MAX / sizeof(maze_cell) / static_cast<uint64_t>(h);
+}
+
+// The renderer works in int pixel coordinates, so both image sides must fit
+// in an int and the whole image in a size_t
+bool validImage(int64_t w, int64_t h, int cell_size) {
+    if (!validSize(w, h) || cell_size < 2) return false;
+    if (w > (INT_MAX - 1) / cell_size || h > (INT_MAX - 1) / cell_size) return false;
+    const uint64_t width = w * cell_size + 1;
+    const uint64_t height = h * cell_size + 1;
+    return width <= SIZE_MAX / 3 / height;
+}
+
+bool validRegion(int64_t w, int64_t h, int64_t x, int64_t y, int64_t rw, int64_t rh) {
+    return x >= 0 && y >= 0 && x < w && y < h && rw > 0 && rh > 0 && rw <= w - x && rh <= h - y;
+}
+
+} // namespace
+
+size_t maze_image_size(int64_t w, int64_t h, int cell_size) {
+    if (!validImage(w, h, cell_size)) return 0;
+    return static_cast<size_t>(w * cell_size + 1) * (h * cell_size + 1) * 3;
+}
+
+int maze_generate(maze_cell* cells, int64_t w, int64_t h, uint32_t seed) {
+    if (!cells || !validSize(w, h)) return MAZE_EINVAL;
+    std::memset(cells, 0, sizeof(maze_cell) * w * h);
+    BasicMaze<CellSpan> m(w, h, span(cells, w, h), seed);
+    m.generate();
+    return MAZE_OK;
+}
+
+int maze_regenerate(maze_cell* cells, int64_t w, int64_t h,
+                    int64_t x, int64_t y, int64_t rw, int64_t rh, uint32_t seed) {
+    if (!cells || !validSize(w, h) || !validRegion(w, h, x, y, rw, rh)) return MAZE_EINVAL;
+    BasicMaze<CellSpan> m(w, h, span(cells, w, h), seed);
+    return m.regenerate(x, y, rw, rh) ? MAZE_OK : MAZE_EINVAL;
+}
+
+int maze_render(const maze_cell* cells, int64_t w, int64_t h,
+                int cell_size, int threads, uint8_t* rgb) {
+    if (!cells || !rgb || !validImage(w, h, cell_size)) return MAZE_EINVAL;
+    const CellSpan grid = span(cells, w, h);
+    const int rows = h * cell_size + 1;
+    if (threads <= 1) {
+        render(grid, rgb, cell_size);
+        return MAZE_OK;
+    }
+    if (threads > rows) threads = rows;
+    auto band = [=](int i) {
+        renderRows(grid, rgb, static_cast<int64_t>(rows) * i / threads, static_cast<int64_t>(rows) * (i + 1) / threads, cell_size);
+    };
+    // No exception may leave a C function. Bands whose thread could not be
+    // started are rendered on the calling thread instead.
+    std::vector<std::thread> pool;
+    int started = 0;
+    try {
+        pool.reserve(threads - 1);
+        for (; started < threads - 1; ++started) {
+            pool.emplace_back(band, started);
+        }
+    } catch (...) {
+    }
+    for (int i = started; i < threads; ++i) {
+        band(i);
+    }
+    for (auto& t : pool) t.join();
+    return MAZE_OK;
+}
+
+int maze_render_rows(const maze_cell* cells, int64_t w, int64_t h,
+                     int cell_size, int64_t py0, int64_t py1, uint8_t* rgb) {
+    if (!cells || !rgb || !validImage(w, h, cell_size)) return MAZE_EINVAL;
+    if (py0 < 0 || py0 > py1 || py1 > h * cell_size + 1) return MAZE_EINVAL;
+    renderRows(span(cells, w, h), rgb, py0, py1, cell_size);
+    return MAZE_OK;
+}
+
+int maze_render_region(const maze_cell* cells, int64_t w, int64_t h,
+                       int64_t x, int64_t y, int64_t rw, int64_t rh,
+                       int cell_size, uint8_t* rgb) {
+    if (!cells || !rgb || !validImage(w, h, cell_size) || !validRegion(w, h, x, y, rw, rh)) return MAZE_EINVAL;
+    renderRegion(span(cells, w, h), rgb, x, y, rw, rh, cell_size);
+    return MAZE_OK;
+}
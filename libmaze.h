@@ -0,0 +1,89 @@
+/*
+ * C API of the maze generator, built as the libmaze shared library.
+ *
+ * All buffers are owned by the caller. A maze of w x h cells is an array of
+ * w * h maze_cell, row major (cell (x, y) at index y * w + x). Its image is
+ * (w * cell_size + 1) x (h * cell_size + 1) RGB pixels, 3 bytes each, rows
+ * top to bottom. Nothing allocates except maze_render() with threads > 1.
+ */
+#ifndef LIBMAZE_H
+#define LIBMAZE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#  if defined(MAZE_BUILD)
+#    define MAZE_API __declspec(dllexport)
+#  else
+#    define MAZE_API __declspec(dllimport)
+#  endif
+#else
+#  define MAZE_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Values of maze_cell.parent, the neighbour one step closer to (0, 0) */
+enum {
+    MAZE_NONE  = 0,
+    MAZE_LEFT  = 1,
+    MAZE_UP    = 2,
+    MAZE_RIGHT = 3,
+    MAZE_DOWN  = 4
+};
+
+/* Return values */
+enum {
+    MAZE_OK     = 0,
+    MAZE_EINVAL = -1
+};
+
+typedef struct maze_cell {
+    uint8_t state;  /* scratch space of the generator */
+    uint8_t parent; /* MAZE_NONE for (0, 0) only */
+} maze_cell;
+
+/* Size in bytes of the image buffer maze_render() writes, or 0 if the image
+ * is too large to render: each side of it must fit in an int. The render
+ * functions return MAZE_EINVAL for such sizes. */
+MAZE_API size_t maze_image_size(int64_t w, int64_t h, int cell_size);
+
+/* Generate a w x h maze into cells. Same seed, same maze. */
+MAZE_API int maze_generate(maze_cell* cells, int64_t w, int64_t h, uint32_t seed);
+
+/* Regenerate the rectangle [x, x + rw) x [y, y + rh) of a generated maze in
+ * place; the rest of cells stays as is. Besides the region, the cost is one
+ * walk along the tree path from the region to (0, 0), so it grows with the
+ * depth of that path, not only with the region size. Returns MAZE_EINVAL,
+ * leaving cells untouched, if that path does not reach (0, 0). */
+MAZE_API int maze_regenerate(maze_cell* cells, int64_t w, int64_t h,
+                             int64_t x, int64_t y, int64_t rw, int64_t rh, uint32_t seed);
+
+/* Render the maze into rgb, of at least maze_image_size() bytes.
+ * threads <= 1 renders on the calling thread and does not allocate.
+ * threads > 1 starts threads - 1 new threads on every call, which allocates;
+ * bands whose thread cannot be started are rendered on the calling thread.
+ * Hosts with their own thread pool should use maze_render_rows() instead. */
+MAZE_API int maze_render(const maze_cell* cells, int64_t w, int64_t h,
+                         int cell_size, int threads, uint8_t* rgb);
+
+/* Render pixel rows [py0, py1) of the image only, without allocating. Every
+ * pixel is written once, so disjoint row ranges can be rendered from
+ * different threads into the same rgb. */
+MAZE_API int maze_render_rows(const maze_cell* cells, int64_t w, int64_t h,
+                              int cell_size, int64_t py0, int64_t py1, uint8_t* rgb);
+
+/* Render only the pixels of cells [x, x + rw) x [y, y + rh), e.g. after
+ * maze_regenerate() on the same region. */
+MAZE_API int maze_render_region(const maze_cell* cells, int64_t w, int64_t h,
+                                int64_t x, int64_t y, int64_t rw, int64_t rh,
+                                int cell_size, uint8_t* rgb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -5,12 +5,24 @@
 
 #include "types.hh"
 
-class Maze {
+// Grid is Cells, or CellSpan to generate into memory owned by someone else
+template <class Grid>
+class BasicMaze {
 public:
-    Maze(int64_t w, int64_t h)
+    BasicMaze(int64_t w, int64_t h)
         : w_{w}
         , h_{h}
         , a(w, std::vector<Cell>(h))
+        , gen_{std::random_device{}()}
+    {
+    }
+
+    // Cells of grid must be zero (NONE) before generate()
+    BasicMaze(int64_t w, int64_t h, Grid grid, uint32_t seed)
+        : w_{w}
+        , h_{h}
+        , a(grid)
+        , gen_{seed}
     {
     }
     
@@ -24,21 +36,84 @@ public:
         }
     }
     
+    // Regenerate only the cells in [x, x + w) x [y, y + h). The region is
+    // detached, refilled by random walks confined to it, and linked back to
+    // the rest of the tree through a single edge, so the grid stays one
+    // spanning tree rooted at (0, 0). Besides the region itself, the cost is
+    // one walk along the old path from the region to (0, 0), i.e. the depth
+    // of that path in the tree, which can be far more than the region size.
+    // Returns false, leaving the grid untouched, if that path does not reach
+    // (0, 0) because the grid is not a generated maze.
+    bool regenerate(int64_t x, int64_t y, int64_t w, int64_t h) {
+        assert(x >= 0 && y >= 0 && w > 0 && h > 0 && x + w <= w_ && y + h <= h_);
+        lo_ = {x, y};
+        hi_ = {x + w - 1, y + h - 1};
+
+        // Find where the region is left for the last time on the way to the
+        // root; everything past that edge does not depend on the region.
+        Point exit = lo_;
+        Dir exitDir = Dir::NONE;
+        if (!inRegion({0, 0})) {
+            int64_t steps = 0;
+            for (Point cur = lo_; cur.x != 0 || cur.y != 0; cur.moveto(a[cur.x][cur.y].parent)) {
+                const Dir d = a[cur.x][cur.y].parent;
+                const bool leavesGrid = (d == Dir::LEFT && cur.x == 0) || (d == Dir::UP && cur.y == 0) ||
+                                        (d == Dir::RIGHT && cur.x == w_ - 1) || (d == Dir::DOWN && cur.y == h_ - 1);
+                if (d == Dir::NONE || d > Dir::DOWN || leavesGrid || ++steps > w_ * h_) {
+                    lo_ = {0, 0};
+                    hi_ = {w_ - 1, h_ - 1};
+                    return false;
+                }
+                if (inRegion(cur)) {
+                    exit = cur;
+                    exitDir = d;
+                }
+            }
+        } else {
+            exit = {0, 0};
+        }
+
+        for (int64_t cx = lo_.x; cx <= hi_.x; ++cx) {
+            for (int64_t cy = lo_.y; cy <= hi_.y; ++cy) {
+                a[cx][cy].state = CellState::NONE;
+                a[cx][cy].parent = Dir::NONE;
+            }
+        }
+        a[exit.x][exit.y].state = CellState::TREE;
+        a[exit.x][exit.y].parent = exitDir;
+
+        for (int64_t cy = lo_.y; cy <= hi_.y; ++cy) {
+            for (int64_t cx = lo_.x; cx <= hi_.x; ++cx) {
+                loopCancleRandomWork({cx, cy});
+            }
+        }
+        lo_ = {0, 0};
+        hi_ = {w_ - 1, h_ - 1};
+        return true;
+    }
+
+    bool inRegion(const Point& p) const {
+        return p.x >= lo_.x && p.x <= hi_.x && p.y >= lo_.y && p.y <= hi_.y;
+    }
+
     Dir randomNextDir(const Point& curPos, Dir prevDir) {
+        // In a one cell wide corridor turning back is the only way to reach
+        // a tree cell behind the start
+        if (lo_.x == hi_.x || lo_.y == hi_.y) prevDir = Dir::NONE;
         while (true) {
             Dir d = static_cast<Dir>(randDir());
             switch (d) {
             case Dir::LEFT:
-                if (prevDir == Dir::RIGHT || curPos.x == 0) continue;
+                if (prevDir == Dir::RIGHT || curPos.x == lo_.x) continue;
                 break;
             case Dir::UP:
-                if (prevDir == Dir::DOWN || curPos.y == 0) continue;
+                if (prevDir == Dir::DOWN || curPos.y == lo_.y) continue;
                 break;
             case Dir::RIGHT:
-                if (prevDir == Dir::LEFT || curPos.x == w_ - 1) continue;
+                if (prevDir == Dir::LEFT || curPos.x == hi_.x) continue;
                 break;
             case Dir::DOWN:
-                if (prevDir == Dir::UP || curPos.y == h_ - 1) continue;
+                if (prevDir == Dir::UP || curPos.y == hi_.y) continue;
                 break;
             case Dir::NONE:
                 assert(0 && "unreachable");
@@ -223,13 +298,17 @@ public:
         return dirDist_(gen_);
     }
     
-    const Cells& cells() const { return a; }
+    const Grid& cells() const { return a; }
 
 private:
     int64_t w_;
     int64_t h_;
-    std::vector<std::vector<Cell>> a;
-    std::random_device rd;  //Will be used to obtain a seed for the random number engine
-    std::mt19937 gen_{rd()}; //Standard mersenne_twister_engine seeded with rd()
+    // Bounds of the random walk, the whole grid unless regenerating a region
+    Point lo_{0, 0};
+    Point hi_{w_ - 1, h_ - 1};
+    Grid a;
+    std::mt19937 gen_; //Standard mersenne_twister_engine seeded with random_device or the given seed
     std::uniform_int_distribution<> dirDist_{1, 4};
-};
\ No newline at end of file
+};
+
+using Maze = BasicMaze<Cells>;
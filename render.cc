@@ -0,0 +1,78 @@
+#include <cstddef>
+#include <cstring>
+#include "render.hh"
+
+namespace {
+
+int width(const Cells& cells) { return cells.size(); }
+int height(const Cells& cells) { return cells[0].size(); }
+int width(const CellSpan& cells) { return cells.w; }
+int height(const CellSpan& cells) { return cells.h; }
+
+// Whether the wall of cell (x, y) in direction d is open
+template <class Grid>
+bool isOpen(const Grid& cells, int x, int y, Dir d) {
+    const int W = width(cells);
+    const int H = height(cells);
+    // entry and exit
+    if (x == 0 && y == 0 && d == Dir::UP) return true;
+    if (x == W - 1 && y == H - 1 && d == Dir::DOWN) return true;
+
+    if (cells[x][y].parent == d) return true;
+    Point n{x, y};
+    n.moveto(d);
+    if (n.x < 0 || n.y < 0 || n.x >= W || n.y >= H) return false;
+    return cells[n.x][n.y].parent == opposite(d);
+}
+
+// Render pixels [px0, px1) x [py0, py1). Each pixel is worked out from the
+// cells on both sides of it, so any rectangle can be redrawn on its own.
+template <class Grid>
+void renderPixels(const Grid& cells, unsigned char* rgb, int px0, int py0, int px1, int py1, const int CELL_SIZE) {
+    const int TOTAL_WIDTH = width(cells) * CELL_SIZE + 1;
+    for(int py = py0; py < py1; ++py) {
+        unsigned char* row = rgb + static_cast<std::size_t>(py) * TOTAL_WIDTH * 3;
+        const bool hline = py % CELL_SIZE == 0;
+        const int y = py / CELL_SIZE;
+        for(int px = px0; px < px1; ++px) {
+            const bool vline = px % CELL_SIZE == 0;
+            const int x = px / CELL_SIZE;
+            bool white;
+            if(!hline && !vline)
+                white = true;
+            else if(hline && vline)
+                white = false;
+            else if(hline)
+                white = y < height(cells) ? isOpen(cells, x, y, Dir::UP) : isOpen(cells, x, y - 1, Dir::DOWN);
+            else
+                white = x < width(cells) ? isOpen(cells, x, y, Dir::LEFT) : isOpen(cells, x - 1, y, Dir::RIGHT);
+            std::memset(row + static_cast<std::size_t>(px) * 3, white ? 255 : 0, 3);
+        }
+    }
+}
+
+} // namespace
+
+void renderRegion(const Cells& cells, unsigned char* rgb, int x, int y, int w, int h, const int CELL_SIZE) {
+    renderPixels(cells, rgb, x * CELL_SIZE, y * CELL_SIZE, (x + w) * CELL_SIZE + 1, (y + h) * CELL_SIZE + 1, CELL_SIZE);
+}
+
+void renderRegion(const CellSpan& cells, unsigned char* rgb, int x, int y, int w, int h, const int CELL_SIZE) {
+    renderPixels(cells, rgb, x * CELL_SIZE, y * CELL_SIZE, (x + w) * CELL_SIZE + 1, (y + h) * CELL_SIZE + 1, CELL_SIZE);
+}
+
+void renderRows(const Cells& cells, unsigned char* rgb, int py0, int py1, const int CELL_SIZE) {
+    renderPixels(cells, rgb, 0, py0, width(cells) * CELL_SIZE + 1, py1, CELL_SIZE);
+}
+
+void renderRows(const CellSpan& cells, unsigned char* rgb, int py0, int py1, const int CELL_SIZE) {
+    renderPixels(cells, rgb, 0, py0, width(cells) * CELL_SIZE + 1, py1, CELL_SIZE);
+}
+
+void render(const Cells& cells, unsigned char* rgb, const int CELL_SIZE) {
+    renderRows(cells, rgb, 0, height(cells) * CELL_SIZE + 1, CELL_SIZE);
+}
+
+void render(const CellSpan& cells, unsigned char* rgb, const int CELL_SIZE) {
+    renderRows(cells, rgb, 0, height(cells) * CELL_SIZE + 1, CELL_SIZE);
+}
@@ -0,0 +1,18 @@
+#pragma once
+#include "types.hh"
+
+// Render into a caller owned RGB buffer, 3 bytes per pixel, rows top to
+// bottom, (w * CELL_SIZE + 1) x (h * CELL_SIZE + 1) pixels. Same picture as
+// the maze part of draw(), without the margin and the solution.
+void render(const Cells& cells, unsigned char* rgb, const int CELL_SIZE = 6);
+void render(const CellSpan& cells, unsigned char* rgb, const int CELL_SIZE = 6);
+
+// Re-render only the pixels of cells [x, x + w) x [y, y + h), e.g. after
+// Maze::regenerate() on the same region.
+void renderRegion(const Cells& cells, unsigned char* rgb, int x, int y, int w, int h, const int CELL_SIZE = 6);
+void renderRegion(const CellSpan& cells, unsigned char* rgb, int x, int y, int w, int h, const int CELL_SIZE = 6);
+
+// Render pixel rows [py0, py1) only. Every pixel is written once, so disjoint
+// row ranges can be rendered from different threads.
+void renderRows(const Cells& cells, unsigned char* rgb, int py0, int py1, const int CELL_SIZE = 6);
+void renderRows(const CellSpan& cells, unsigned char* rgb, int py0, int py1, const int CELL_SIZE = 6);
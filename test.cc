@@ -2,22 +2,33 @@
 #include <time.h>
 #include <string>
 #include "maze.hh"
+#include "backtracker.hh"
 #include "draw.hh"
 
 int main(int argc, char* argv[]) noexcept {
-    // srand(time(NULL));
+    // -b picks the depth first Backtracker instead of Maze
+    const bool backtracker = argc > 1 && std::string(argv[1]) == "-b";
+    if (backtracker) {
+        --argc;
+        ++argv;
+    }
     if (argc < 3 || argc > 4) {
-        std::cout << "Usage maze <w> <h> [random_seed]" << std::endl;
+        std::cout << "Usage maze [-b] <w> <h> [random_seed]" << std::endl;
         return 0;
     }
-    if (argc == 4) {
-        srand(std::stoi(argv[3]));
+    const int64_t w = std::stoi(argv[1]);
+    const int64_t h = std::stoi(argv[2]);
+    const uint32_t seed = argc == 4 ? std::stoul(argv[3]) : time(NULL);
+    std::cout << "start" << std::endl;
+    if (backtracker) {
+        Backtracker m(w, h, seed);
+        m.generate();
+        std::cout << "done" << std::endl;
+        draw(m.cells(), "backtracker", true, 4);
     } else {
-        srand(time(NULL));
+        Maze m(w, h, Cells(w, std::vector<Cell>(h)), seed);
+        m.generate();
+        std::cout << "done" << std::endl;
+        draw(m.cells(), "ker", true, 4);
     }
-    Maze m(std::stoi(argv[1]), std::stoi(argv[2]));
-    std::cout << "start" << std::endl;
-    m.generate();
-    std::cout << "done" << std::endl;
-    draw(m.cells(), "ker", true, 4);
 }
@@ -1,12 +1,15 @@
 #pragma once
 #include <vector>
+#include <cstdint>
 #include <iostream>
 
-enum class CellState {
+// One byte each, a Cell is two bytes and shares its layout with maze_cell of
+// the C API (libmaze.h)
+enum class CellState : uint8_t {
     NONE, PATH, TREE
 };
 
-enum class Dir {
+enum class Dir : uint8_t {
     NONE, LEFT, UP, RIGHT, DOWN
 };
 
@@ -35,6 +38,31 @@ struct Point {
 
 using Cells = std::vector<std::vector<Cell>>;
 
+// Row major view over a caller owned array of w * h cells, indexed
+// cells[x][y] like Cells
+struct CellSpan {
+    struct Column {
+        Cell& operator[](int64_t y) const { return p[y * w]; }
+        Cell* p;
+        int64_t w;
+    };
+    Column operator[](int64_t x) const { return {data + x, w}; }
+    Cell* data;
+    int64_t w;
+    int64_t h;
+};
+
+inline Dir opposite(Dir d) noexcept {
+    switch(d) {
+    case Dir::NONE : return Dir::NONE;
+    case Dir::LEFT : return Dir::RIGHT;
+    case Dir::UP   : return Dir::DOWN;
+    case Dir::RIGHT: return Dir::LEFT;
+    case Dir::DOWN : return Dir::UP;
+    }
+    return Dir::NONE;
+}
+
 inline std::ostream& operator<<(std::ostream& os, Dir d) {
     switch(d) {
     case Dir::NONE : return os << "NONE ";